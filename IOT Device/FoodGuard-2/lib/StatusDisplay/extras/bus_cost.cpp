@@ -0,0 +1,127 @@
+// Host benchmark: I2C cost of diff updates vs a naive full redraw
+// Every update is decoded by MockLcdBus and must leave the composed frame on the
+// glass with RS settled before each EN strobe, also after an injected NACK;
+// any mismatch fails the run.
+// Build from this directory:
+//   g++ -std=c++11 -O2 -I../src bus_cost.cpp ../src/LcdFrame.cpp -o bus_cost && ./bus_cost
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "LcdFrame.h"
+#include "MockLcdBus.h"
+
+static const LcdStatus SCRIPT[] = {
+  { LCD_OFF,         0,    NAN,   NAN,   '=' },
+  { LCD_CALIBRATING, 0,    NAN,   NAN,   '=' },
+  { LCD_FRESH,       612,  22.5f, 71.0f, '=' },
+  { LCD_FRESH,       615,  22.5f, 71.0f, '=' },   // within the trend deadband: one digit changes
+  { LCD_FRESH,       615,  22.5f, 71.0f, '=' },   // same reading: nothing sent
+  { LCD_FRESH,       640,  22.6f, 71.0f, '^' },
+  { LCD_READY,       0,    NAN,   NAN,   '=' },
+  { LCD_FRESH,       640,  22.6f, 71.0f, '^' },   // reposted after the LED sequence: still rising
+  { LCD_ATTENTION,   760,  22.6f, 72.0f, '^' },
+  { LCD_ATTENTION,   790,  22.7f, 72.0f, '^' },
+  { LCD_SPOILED,     1015, 22.7f, 73.0f, '^' },
+  { LCD_SPOILED,     1010, NAN,   NAN,   '=' },   // DHT read error
+  { LCD_SPOILED,     980,  22.8f, 73.0f, 'v' },
+  { LCD_NO_READING,  0,    NAN,   NAN,   '=' },   // later activation: the sensor task stays asleep
+};
+
+// --- Naive redraw: what LiquidCrystal_I2C clear()/setCursor()/print() put on the bus ---
+static void strobeByte(LcdBus &bus, uint8_t value, uint8_t mode) {
+  uint8_t nibbles[2] = { (uint8_t)(value & 0xF0), (uint8_t)((value << 4) & 0xF0) };
+  for(uint8_t i=0; i<2; i++){
+    uint8_t v = nibbles[i] | mode | LCD_BACKLIGHT;
+    uint8_t en = v | LCD_EN;
+    bus.transmit(&v, 1);
+    bus.transmit(&en, 1); bus.delayUs(1);
+    bus.transmit(&v, 1);  bus.delayUs(50);
+  }
+}
+
+static void redraw(LcdBus &bus, const LcdFrame &frame) {
+  static const uint8_t ROW_ADDR[LCD_ROWS] = { 0x00, 0x40 };
+  strobeByte(bus, LCD_CMD_CLEAR, 0); bus.delayUs(2000);
+  for(uint8_t row=0; row<LCD_ROWS; row++){
+    strobeByte(bus, LCD_CMD_DDRAM | ROW_ADDR[row], 0);
+    for(uint8_t c=0; c<LCD_COLS; c++) strobeByte(bus, (uint8_t)frame.cell(row, c), LCD_RS);
+  }
+}
+
+static bool onGlass(const MockLcdBus &bus, const LcdFrame &frame) {
+  for(uint8_t r=0; r<LCD_ROWS; r++)
+    for(uint8_t c=0; c<LCD_COLS; c++)
+      if(bus.cell(r, c) != frame.cell(r, c)) return false;
+  return bus.setupViolations == 0;
+}
+
+// Random frames exercise run bridging and cursor tracking beyond the script
+static bool sweep(unsigned frames) {
+  MockLcdBus bus;
+  LcdFrame frame(bus);
+  srand(1);
+  for(unsigned i=0; i<frames; i++){
+    LcdStatus s = { (LcdState)(rand() % (LCD_SPOILED + 1)), rand() % 4096,
+                    rand() % 8 ? (rand() % 500) / 10.0f : NAN, rand() % 8 ? (float)(rand() % 100) : NAN,
+                    "^v="[rand() % 3] };
+    frame.compose(s);
+    frame.flush();
+    if(!onGlass(bus, frame)) { printf("sweep: frame %u not on the glass\n", i); return false; }
+  }
+  return true;
+}
+
+// NACK each transaction of a two-transaction update in turn: flush() must report
+// it, and after invalidate() the next flush() must put the whole frame back.
+static bool recovers() {
+  for(long k=0; k<2; k++){
+    MockLcdBus bus;
+    LcdFrame frame(bus);
+    frame.compose(SCRIPT[0]); frame.flush();
+    frame.compose(SCRIPT[1]);
+    bus.failIn = k;
+    if(frame.flush() || onGlass(bus, frame)) { printf("NACK in transaction %ld not reported\n", k); return false; }
+    frame.invalidate();
+    if(!frame.flush() || !onGlass(bus, frame)) { printf("no recovery after NACK in transaction %ld\n", k); return false; }
+  }
+  return true;
+}
+
+int main() {
+  bool ok = true;
+  MockLcdBus diffBus, fullBus;
+  LcdFrame diff(diffBus), full(fullBus);
+  unsigned long diffTx=0, diffBytes=0, diffUs=0, fullTx=0, fullBytes=0, fullUs=0;
+  const size_t n = sizeof(SCRIPT)/sizeof(SCRIPT[0]);
+
+  printf("%-4s | %-16s | %8s %6s %8s | %8s %6s %8s\n",
+         "step", "row 0", "diff tx", "bytes", "us", "full tx", "bytes", "us");
+  for(size_t i=0; i<n; i++){
+    diffBus.reset(); fullBus.reset();
+    diff.compose(SCRIPT[i]); diff.flush();
+    full.compose(SCRIPT[i]); redraw(fullBus, full);
+    if(!onGlass(diffBus, diff) || !onGlass(fullBus, full)) { printf("step %zu: LCD does not show the frame\n", i); ok = false; }
+    if(SCRIPT[i].state >= LCD_FRESH && diff.cell(0, LCD_COLS-1) != SCRIPT[i].trend) {
+      printf("step %zu: trend '%c', expected '%c'\n", i, diff.cell(0, LCD_COLS-1), SCRIPT[i].trend); ok = false;
+    }
+
+    char label[LCD_COLS+1] = {0};
+    for(uint8_t c=0; c<LCD_COLS; c++) label[c] = diff.cell(0, c);
+    printf("%-4zu | %-16s | %8lu %6lu %8lu | %8lu %6lu %8lu\n", i, label,
+           diffBus.transactions, diffBus.bytes, diffBus.busUs(),
+           fullBus.transactions, fullBus.bytes, fullBus.busUs());
+
+    diffTx += diffBus.transactions; diffBytes += diffBus.bytes; diffUs += diffBus.busUs();
+    fullTx += fullBus.transactions; fullBytes += fullBus.bytes; fullUs += fullBus.busUs();
+  }
+
+  printf("\ntotal (100 kHz): diff %lu tx / %lu bytes / %lu us, full %lu tx / %lu bytes / %lu us\n",
+         diffTx, diffBytes, diffUs, fullTx, fullBytes, fullUs);
+  printf("bus time saved: %.1f%%\n", fullUs ? 100.0 * (double)(fullUs - diffUs) / (double)fullUs : 0.0);
+
+  ok = recovers() && ok;
+  ok = sweep(200000) && ok;
+  printf("decoded screen: %s\n", ok ? "ok" : "FAIL");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,23 @@
+// I2C transport for a 16x2 HD44780 LCD behind a PCF8574 backpack
+// The only place that touches the bus: swap it for MockLcdBus on the host.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// --- PCF8574 -> HD44780 wiring (same as LiquidCrystal_I2C) ---
+#define LCD_RS        0x01   // P0: register select (1 = data)
+#define LCD_EN        0x04   // P2: enable strobe
+#define LCD_BACKLIGHT 0x08   // P3: backlight transistor
+
+// --- HD44780 commands ---
+#define LCD_CMD_CLEAR   0x01
+#define LCD_CMD_DDRAM   0x80
+
+class LcdBus {
+public:
+  virtual ~LcdBus() {}
+  // One I2C transaction (START, address, len bytes, STOP); false if not acknowledged
+  virtual bool transmit(const uint8_t *data, size_t len) = 0;
+  virtual void delayUs(uint32_t us) = 0;
+};
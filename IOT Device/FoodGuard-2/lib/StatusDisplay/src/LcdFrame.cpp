@@ -0,0 +1,99 @@
+#include "LcdFrame.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static const uint8_t ROW_ADDR[LCD_ROWS] = { 0x00, 0x40 };
+
+LcdFrame::LcdFrame(LcdBus &b) : bus(b), cursor(0), lastMode(-1), batchLen(0), batchFailed(false) {
+  memset(target, ' ', sizeof(target));
+  memset(shown, ' ', sizeof(shown));
+}
+
+// --- Formatting ---
+void LcdFrame::print(uint8_t row, const char *text) {
+  if(row >= LCD_ROWS) return;
+  size_t n = strlen(text);
+  for(uint8_t c=0; c<LCD_COLS; c++) target[row][c] = (c<n)? text[c] : ' ';
+}
+
+void LcdFrame::compose(const LcdStatus &s) {
+  char line[LCD_COLS+1];
+
+  if(s.state == LCD_OFF)         { print(0, "SYSTEM OFF");     print(1, "Press to start"); return; }
+  if(s.state == LCD_CALIBRATING) { print(0, "CALIBRATING..."); print(1, "Do not approach"); return; }
+  if(s.state == LCD_READY)       { print(0, "READY");          print(1, "Approach food");   return; }
+  if(s.state == LCD_NO_READING)  { print(0, "NO READING");     print(1, "Reset to retry");  return; }
+
+  const char *label = s.state==LCD_SPOILED ? "SPOILED" : s.state==LCD_ATTENTION ? "ATTENTION" : "FRAIS";
+  snprintf(line, sizeof(line), "%-12sMQ %c", label, s.trend ? s.trend : '=');
+  print(0, line);
+
+  char t[8], h[8];
+  if(isnan(s.temp)) strcpy(t, "Err"); else snprintf(t, sizeof(t), "%.1fC", s.temp);
+  if(isnan(s.hum))  strcpy(h, "Err"); else snprintf(h, sizeof(h), "%d%%", (int)s.hum);
+  snprintf(line, sizeof(line), "%4d %6s %4s", s.mq, t, h);
+  print(1, line);
+}
+
+// --- Batched transport ---
+// Each LCD byte is two nibbles, each latched by EN high then EN low: 4 expander bytes.
+// The bus runs at 100 kHz (LCD_I2C_CLOCK), so one expander byte takes 90 us and
+// consecutive latches are two bytes (180 us) apart, well over the 37 us an HD44780
+// needs per command even with a slow oscillator. No delays are needed between strobes.
+// RS must settle before EN rises (tAS), so a mode change costs one extra byte with EN low.
+void LcdFrame::queueByte(uint8_t value, uint8_t mode) {
+  if(batchLen + 5 > sizeof(batch)) commit();
+  uint8_t hi = (value & 0xF0) | mode | LCD_BACKLIGHT;
+  uint8_t lo = ((value << 4) & 0xF0) | mode | LCD_BACKLIGHT;
+  if(lastMode != mode) { batch[batchLen++] = hi; lastMode = mode; }
+  batch[batchLen++] = hi | LCD_EN;
+  batch[batchLen++] = hi;
+  batch[batchLen++] = lo | LCD_EN;
+  batch[batchLen++] = lo;
+}
+
+bool LcdFrame::commit() {
+  if(batchLen == 0) return true;
+  bool ok = bus.transmit(batch, batchLen);
+  if(!ok) batchFailed = true;
+  batchLen = 0;
+  return ok;
+}
+
+// shown[] is updated as cells are queued; if any transaction fails the caller
+// must invalidate(), since the glass no longer matches it.
+bool LcdFrame::flush() {
+  batchFailed = false;
+  for(uint8_t row=0; row<LCD_ROWS; row++){
+    uint8_t col = 0;
+    while(col < LCD_COLS){
+      if(!changed(row, col)) { col++; continue; }
+
+      // Extend the run; a single unchanged cell costs the same as a set-cursor, so bridge it
+      uint8_t end = col + 1;
+      while(end < LCD_COLS){
+        if(changed(row, end)) end++;
+        else if(end+1 < LCD_COLS && changed(row, end+1)) end += 2;
+        else break;
+      }
+
+      int addr = ROW_ADDR[row] + col;
+      if(cursor != addr) queueByte(LCD_CMD_DDRAM | addr, 0);
+      for(uint8_t c=col; c<end; c++){
+        queueByte((uint8_t)target[row][c], LCD_RS);
+        shown[row][c] = target[row][c];
+      }
+      cursor = ROW_ADDR[row] + end;
+      col = end;
+    }
+  }
+  commit();
+  return !batchFailed;
+}
+
+void LcdFrame::invalidate() {
+  memset(shown, 0, sizeof(shown));   // never a printable char, so every cell differs
+  cursor = -1;
+  lastMode = -1;
+}
@@ -0,0 +1,66 @@
+// Shadow framebuffer for the 16x2 status LCD
+// compose() fills the target frame, flush() sends only the cells that differ
+// from what the LCD already shows, packed into as few I2C transactions as possible.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "LcdBus.h"
+
+#define LCD_COLS 16
+#define LCD_ROWS 2
+
+#ifndef LCD_I2C_BATCH
+#define LCD_I2C_BATCH 128        // bytes per transaction (ESP32 Wire buffer)
+#endif
+static_assert(LCD_I2C_BATCH >= 5, "LCD_I2C_BATCH must hold one LCD byte plus an RS setup byte");
+
+#ifndef LCD_TREND_DEADBAND
+#define LCD_TREND_DEADBAND 10    // MQ counts ignored as ADC noise
+#endif
+
+// What the sensor side wants on screen
+enum LcdState { LCD_OFF=0, LCD_CALIBRATING, LCD_READY, LCD_NO_READING, LCD_FRESH, LCD_ATTENTION, LCD_SPOILED };
+
+struct LcdStatus {
+  LcdState state;
+  int   mq;
+  float temp;   // NAN when the DHT read failed
+  float hum;    // NAN when the DHT read failed
+  char  trend;  // '^' rising, 'v' falling, '=' steady, see lcdTrend()
+};
+
+// MQ trend between two readings, computed once by whoever takes them
+inline char lcdTrend(int from, int to) {
+  if(to - from > LCD_TREND_DEADBAND) return '^';
+  if(from - to > LCD_TREND_DEADBAND) return 'v';
+  return '=';
+}
+
+class LcdFrame {
+public:
+  // Assumes the LCD was just initialised: blank, cursor at (0,0)
+  explicit LcdFrame(LcdBus &bus);
+
+  void compose(const LcdStatus &s);           // no side effects: same status, same frame
+  void print(uint8_t row, const char *text);   // padded/truncated to LCD_COLS
+
+  bool flush();        // diff update, false if a transaction failed: invalidate() and retry
+  void invalidate();   // forget what is on the glass (failed write, LCD reset)
+  char cell(uint8_t row, uint8_t col) const { return target[row][col]; }
+
+private:
+  void queueByte(uint8_t value, uint8_t mode);
+  bool commit();
+  bool changed(uint8_t row, uint8_t col) const { return target[row][col] != shown[row][col]; }
+
+  LcdBus &bus;
+  char target[LCD_ROWS][LCD_COLS];
+  char shown[LCD_ROWS][LCD_COLS];
+  int  cursor;         // current DDRAM address, -1 if unknown
+  int  lastMode;       // RS level of the last expander write, -1 if unknown
+
+  uint8_t batch[LCD_I2C_BATCH];
+  size_t  batchLen;
+  bool    batchFailed;   // a commit() since the last flush() was not acknowledged
+};
@@ -0,0 +1,59 @@
+// Host-side LcdBus: counts traffic instead of driving a PCF8574
+// It also decodes the expander writes the way an HD44780 latches them, so
+// extras/bus_cost.cpp can check that what reaches the glass is what was composed.
+
+#pragma once
+#include <string.h>
+#include "LcdBus.h"
+
+class MockLcdBus : public LcdBus {
+public:
+  unsigned long transactions = 0;
+  unsigned long bytes = 0;        // payload only, address byte not included
+  unsigned long delayedUs = 0;    // explicit delays requested by the driver
+  unsigned long setupViolations = 0;   // EN rose in the same write that changed RS (tAS)
+  long failIn = -1;               // NACK the transaction this many calls from now (0 = next), -1 = never
+
+  MockLcdBus() { memset(ddram, ' ', sizeof(ddram)); }
+
+  bool transmit(const uint8_t *data, size_t len) override {
+    transactions++; bytes += len;
+    if(failIn >= 0 && failIn-- == 0) return false;   // NACKed: nothing reaches the LCD
+    for(size_t i=0; i<len; i++) port(data[i]);
+    return true;
+  }
+  void delayUs(uint32_t us) override { delayedUs += us; }
+
+  void reset() { transactions = bytes = delayedUs = setupViolations = 0; }
+
+  // Wire time: START + address + ACK + STOP per transaction, 9 bits per data byte
+  unsigned long busUs(unsigned long clockHz = 100000) const {
+    unsigned long bits = transactions * 11 + bytes * 9;
+    return (unsigned long)((unsigned long long)bits * 1000000ULL / clockHz) + delayedUs;
+  }
+
+  // Character shown at (row, col) of a 16x2 display
+  char cell(uint8_t row, uint8_t col) const { return ddram[(row ? 0x40 : 0x00) + col]; }
+
+private:
+  void port(uint8_t v) {
+    if(!(last & LCD_EN) && (v & LCD_EN) && ((v ^ last) & LCD_RS)) setupViolations++;
+    if((last & LCD_EN) && !(v & LCD_EN)) latch(v);
+    last = v;
+  }
+
+  void latch(uint8_t v) {
+    if(highNibble) { acc = v & 0xF0; highNibble = false; return; }
+    acc |= v >> 4;
+    highNibble = true;
+    if(v & LCD_RS) { ddram[addr] = (char)acc; addr = (addr + 1) & 0x7F; }
+    else if(acc & LCD_CMD_DDRAM) addr = acc & 0x7F;
+    else if(acc == LCD_CMD_CLEAR) { memset(ddram, ' ', sizeof(ddram)); addr = 0; }
+  }
+
+  char ddram[128];
+  uint8_t addr = 0;
+  uint8_t acc = 0;
+  uint8_t last = 0;
+  bool highNibble = true;
+};
@@ -0,0 +1,68 @@
+#include "StatusDisplay.h"
+#include <Arduino.h>
+#include <Wire.h>
+#include <LiquidCrystal_I2C.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+#if defined(I2C_BUFFER_LENGTH) && LCD_I2C_BATCH > I2C_BUFFER_LENGTH
+#error "LCD_I2C_BATCH exceeds the Wire buffer (I2C_BUFFER_LENGTH)"
+#elif defined(BUFFER_LENGTH) && LCD_I2C_BATCH > BUFFER_LENGTH
+#error "LCD_I2C_BATCH exceeds the Wire buffer (BUFFER_LENGTH)"
+#endif
+
+// --- Wire-backed bus ---
+class WireLcdBus : public LcdBus {
+public:
+  explicit WireLcdBus(uint8_t a) : addr(a) {}
+  bool transmit(const uint8_t *data, size_t len) override {
+    Wire.beginTransmission(addr);
+    Wire.write(data, len);
+    return Wire.endTransmission() == 0;
+  }
+  void delayUs(uint32_t us) override { delayMicroseconds(us); }
+private:
+  uint8_t addr;
+};
+
+static QueueHandle_t lcdMailbox = NULL;
+static LcdFrame *frame = NULL;
+
+// --- Display Task ---
+// A failed write leaves the glass unknown: repaint everything, on the next
+// post or after LCD_RETRY_MS if none comes.
+static void taskDisplay(void *pvParameters) {
+  LcdStatus s;
+  bool dirty = false;
+  for(;;){
+    TickType_t wait = dirty ? LCD_RETRY_MS/portTICK_PERIOD_MS : portMAX_DELAY;
+    if(xQueueReceive(lcdMailbox, &s, wait) == pdTRUE) frame->compose(s);
+    else if(!dirty) continue;
+    dirty = !frame->flush();
+    if(dirty) frame->invalidate();
+  }
+}
+
+bool displayBegin(uint8_t addr) {
+  if(lcdMailbox) return true;
+
+  // LiquidCrystal_I2C does the timed 4-bit init sequence; updates go through LcdFrame
+  static LiquidCrystal_I2C lcd(addr, LCD_COLS, LCD_ROWS);
+  lcd.init();
+  lcd.backlight();
+  Wire.setClock(LCD_I2C_CLOCK);
+
+  static WireLcdBus bus(addr);
+  static LcdFrame lcdFrame(bus);
+  frame = &lcdFrame;
+
+  lcdMailbox = xQueueCreate(1, sizeof(LcdStatus));
+  if(!lcdMailbox) return false;
+
+  // Idle priority on core 0: loop() spins on core 1 and would starve it there
+  return xTaskCreatePinnedToCore(taskDisplay, "Display Task", 3072, NULL, tskIDLE_PRIORITY, NULL, 0) == pdPASS;
+}
+
+void displayPost(const LcdStatus &s) {
+  if(lcdMailbox) xQueueOverwrite(lcdMailbox, &s);
+}
@@ -0,0 +1,13 @@
+// Status LCD (16x2 I2C) driven from its own low-priority FreeRTOS task
+// displayPost() never blocks: it overwrites a one-slot mailbox, so the
+// sensor path only pays for a memcpy even when the I2C bus is busy.
+
+#pragma once
+#include "LcdFrame.h"
+
+#define LCD_I2C_ADDR  0x27
+#define LCD_I2C_CLOCK 100000   // LcdFrame relies on 90 us per byte between latches
+#define LCD_RETRY_MS  1000     // repaint delay after a failed I2C write
+
+bool displayBegin(uint8_t addr = LCD_I2C_ADDR);
+void displayPost(const LcdStatus &s);
@@ -2,6 +2,7 @@
 #include <DHT.h>
 #include <WiFi.h>
 #include <PubSubClient.h>
+#include <StatusDisplay.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
 
@@ -24,6 +25,7 @@ SemaphoreHandle_t semLED;
 volatile bool running = false;
 volatile bool inSequence = false;
 float baselineMQ = 1.0;
+LcdStatus lastReading = {LCD_NO_READING, 0, NAN, NAN};   // this activation's reading, guarded by xMutex
 const uint32_t CALIB_MS = 5000;
 
 // --- Thresholds and Factors ---
@@ -88,6 +90,11 @@ void taskLED(void *pvParameters) {
 
       if(running) {
         Serial.println(">>> System ON");
+        displayPost({LCD_CALIBRATING, 0, NAN, NAN});
+        if(xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE){
+          lastReading = {LCD_NO_READING, 0, NAN, NAN};
+          xSemaphoreGive(xMutex);
+        }
 
         // Calibration
         if(xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE){
@@ -108,6 +115,7 @@ void taskLED(void *pvParameters) {
           Serial.println(">> Approach sensor to food. LED sequence starts.");
           xSemaphoreGive(xMutex);
         }
+        displayPost({LCD_READY, 0, NAN, NAN});
 
         // LED Sequence
         inSequence = true;
@@ -117,9 +125,17 @@ void taskLED(void *pvParameters) {
         allOff();
         inSequence = false;
 
+        // Leave the reading on screen, or NO READING if none was taken this activation
+        if(xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE){
+          LcdStatus shown = lastReading;
+          xSemaphoreGive(xMutex);
+          displayPost(shown);
+        }
+
       } else {
         Serial.println(">>> System OFF");
         allOff();
+        displayPost({LCD_OFF, 0, NAN, NAN});
       }
     }
   }
@@ -128,6 +144,7 @@ void taskLED(void *pvParameters) {
 // --- Sensor Task: read & publish only once per activation ---
 void taskSensors(void *pvParameters) {
   FoodType currentFood = GENERIC;
+  int prevMq = -1;   // previous reading, for the LCD trend
   for(;;){
     if(!running){ vTaskDelay(200/portTICK_PERIOD_MS); continue; }
 
@@ -170,8 +187,15 @@ void taskSensors(void *pvParameters) {
       if(tempRisk && mqRatio>=(eff_red*0.95f)) isRed=true;
     }
 
+    // Hand off to the display task (never blocks)
+    LcdStatus reading = {isRed?LCD_SPOILED:isYellow?LCD_ATTENTION:LCD_FRESH, mqValue, temp, hum,
+                         prevMq<0? '=' : lcdTrend(prevMq, mqValue)};
+    prevMq = mqValue;
+    displayPost(reading);
+
     // Critical section
     if(xSemaphoreTake(xMutex, portMAX_DELAY)==pdTRUE){
+      lastReading = reading;
       String stateStr = isRed?"SPOILED":isYellow?"ATTENTION":"FRAIS";
       if(isRed) setLEDRed();
       else if(isYellow) setLEDYellow();
@@ -210,6 +234,8 @@ void setup() {
   dht.begin();
 
   allOff();
+  if(!displayBegin()) Serial.println("LCD display not started");
+  displayPost({LCD_OFF, 0, NAN, NAN});
   xMutex = xSemaphoreCreateMutex();
   semLED = xSemaphoreCreateBinary();
   attachInterrupt(BUTTON_PIN, buttonISR, FALLING);
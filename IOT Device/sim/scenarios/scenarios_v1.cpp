@@ -0,0 +1,106 @@
+// Scenarios for FoodGuard-1 (continuous monitoring, reading + publish every 2 s)
+
+#include "Sim.h"
+#include <math.h>
+
+using namespace sim;
+
+namespace {
+
+// Mirrors FoodGuard-1/src/main.cpp
+const int LED_GREEN = 25, LED_YELLOW = 26, LED_RED = 27;
+const uint64_t PERIOD   = 2 * SEC;         // taskSensors cycle
+const uint64_t CALIB    = 5 * SEC;         // CALIB_MS
+const uint64_t SEQUENCE = 6 * SEC;         // green/yellow/red LED sequence
+const uint64_t RETRY    = 2 * SEC + 1 * SEC;   // reconnectMQTT delay + failed connect
+
+World fridge(std::function<int(uint64_t)> mq) {
+  World w;
+  w.mq = mq;
+  w.temp = constant(4.0f);
+  w.hum = constant(70.0f);
+  return w;
+}
+
+// Window in which a threshold ratio*baseline is first reported: the curve may
+// sit on the rounded level for a while, so allow one count either side plus a cycle.
+void expectCrossing(Check &c, const Trace &t, const World &w, const char *state, float ratio, uint64_t pressMs, uint64_t toMs) {
+  const uint64_t settled = pressMs + CALIB + SEQUENCE;
+  const int level = (int)ceilf(ratio * w.mq(pressMs));
+  const uint64_t lo = crossingMs(w.mq, level - 1, settled, toMs);
+  const uint64_t hi = crossingMs(w.mq, level + 1, settled, toMs);
+  const Publish *p = firstPublish(t, settled, state);
+  c.expect(p != nullptr, "no %s publish after calibration", state);
+  if(p) c.between(state, p->ms, lo, hi == UINT64_MAX ? toMs : hi + PERIOD);
+}
+
+std::vector<Scenario> build() {
+  std::vector<Scenario> v;
+
+  v.push_back({ "boot_connect", "WiFi joins after 3 s, MQTT connects, nothing published while OFF",
+    1 * MIN, fridge([](uint64_t) { return 600; }), {},
+    [](const Trace &t, Check &c) {
+      c.expect(serialContains(t, "READY"), "READY banner missing");
+      c.expect(!t.mqttConnects.empty(), "never connected to MQTT");
+      if(!t.mqttConnects.empty()) c.within("MQTT connect", t.mqttConnects[0], 3 * SEC, 100);
+      c.expect(t.publishes.empty(), "%zu publishes while OFF", t.publishes.size());
+    } });
+
+  {
+    const uint64_t press0 = 10 * SEC, dur = 48 * HOUR;
+    World w = fridge(logistic(600, 1300, 30 * HOUR, 20 * HOUR));
+    v.push_back({ "spoilage_48h", "Chicken in the fridge spoils over two days: FRAIS -> ATTENTION -> SPOILED",
+      dur, w, { press(press0) },
+      [w, press0, dur](const Trace &t, Check &c) {
+        expectCrossing(c, t, w, "ATTENTION", 1.20f, press0, dur);
+        expectCrossing(c, t, w, "SPOILED", 1.50f, press0, dur);
+
+        const Publish *red = firstPublish(t, press0 + CALIB + SEQUENCE, "SPOILED");
+        if(red) c.expect(pinLevel(t, LED_RED, red->ms) == 1, "red LED off when SPOILED was published");
+
+        size_t expected = (size_t)((dur - press0) / PERIOD);
+        size_t n = countPublishes(t, 0, dur);
+        c.expect(n + 2 >= expected && n <= expected + 2, "%zu publishes, expected ~%zu", n, expected);
+      },
+      1000 });
+  }
+
+  {
+    const uint64_t press0 = 10 * SEC, down = 1 * HOUR, up = down + 30 * MIN + 1500;   // mid-way through a retry
+    v.push_back({ "broker_outage", "Broker unreachable for 30 min, firmware keeps retrying and resumes",
+      3 * HOUR, fridge(logistic(600, 620, 2 * HOUR, 1 * HOUR)), { press(press0), brokerDown(down), brokerUp(up) },
+      [down, up](const Trace &t, Check &c) {
+        c.expect(countPublishes(t, down + 1, up) == 0, "published while the broker was down");
+        const Publish *p = firstPublish(t, up);
+        c.expect(p != nullptr, "no publish after recovery");
+        if(p) c.between("first publish after recovery", p->ms, up, up + RETRY + PERIOD);
+
+        uint64_t reconnect = 0;
+        for(uint64_t ms : t.mqttConnects) if(ms >= up) { reconnect = ms; break; }
+        c.expect(reconnect != 0, "never reconnected");
+        if(reconnect) c.between("reconnect", reconnect, up, up + RETRY + 100);
+      },
+      100 });
+  }
+
+  {
+    const uint64_t on = 10 * SEC, off = 5 * MIN;
+    v.push_back({ "toggle_off", "Second press stops monitoring and turns the LEDs off",
+      10 * MIN, fridge([](uint64_t) { return 600; }), { press(on), press(off) },
+      [on, off](const Trace &t, Check &c) {
+        c.expect(countPublishes(t, off + 1, 10 * MIN) == 0, "published after System OFF");
+        c.expect(countPublishes(t, on + CALIB + SEQUENCE, off) > 0, "no publishes while ON");
+        for(int pin : { LED_GREEN, LED_YELLOW, LED_RED })
+          c.expect(pinLevel(t, pin, 10 * MIN) == 0, "LED %d still on after System OFF", pin);
+      } });
+  }
+
+  return v;
+}
+
+} // namespace
+
+const std::vector<Scenario> &sim::scenarios() {
+  static const std::vector<Scenario> all = build();
+  return all;
+}
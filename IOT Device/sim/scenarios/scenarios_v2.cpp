@@ -0,0 +1,107 @@
+// Scenarios for FoodGuard-2 (one reading + publish per activation, status LCD)
+
+#include "Sim.h"
+#include <string.h>
+
+using namespace sim;
+
+namespace {
+
+// Mirrors FoodGuard-2/src/main.cpp
+const int LED_GREEN = 25, LED_YELLOW = 26, LED_RED = 27;
+const uint64_t POLL  = 200;                    // taskSensors idle poll
+const uint64_t CALIB = 5 * SEC;                // CALIB_MS
+const uint64_t SEQUENCE = 6 * SEC;             // green/yellow/red LED sequence
+const uint64_t RETRY = 2 * SEC + 1 * SEC;      // reconnectMQTT delay + failed connect
+
+World fridge() {
+  World w;
+  w.mq = [](uint64_t) { return 600; };
+  w.temp = constant(4.0f);
+  w.hum = constant(70.0f);
+  return w;
+}
+
+bool lcdShows(const Trace &t, const char *text, int row = 0) { return strncmp(t.lcd[row], text, strlen(text)) == 0; }
+
+std::vector<Scenario> build() {
+  std::vector<Scenario> v;
+
+  v.push_back({ "boot_connect", "WiFi joins after 3 s, MQTT connects, LCD shows SYSTEM OFF",
+    1 * MIN, fridge(), {},
+    [](const Trace &t, Check &c) {
+      c.expect(serialContains(t, "READY"), "READY banner missing");
+      c.expect(!t.mqttConnects.empty(), "never connected to MQTT");
+      if(!t.mqttConnects.empty()) c.within("MQTT connect", t.mqttConnects[0], 3 * SEC, 100);
+      c.expect(lcdShows(t, "SYSTEM OFF"), "LCD row 0 is \"%s\"", t.lcd[0]);
+    } });
+
+  {
+    const uint64_t press0 = 10 * SEC, dur = 24 * HOUR;
+    v.push_back({ "one_shot_24h", "One press gives exactly one reading, publish and LCD update in a day",
+      dur, fridge(), { press(press0) },
+      [press0, dur](const Trace &t, Check &c) {
+        c.expect(t.publishes.size() == 1, "%zu publishes, expected 1", t.publishes.size());
+        if(t.publishes.empty()) return;
+        c.between("publish", t.publishes[0].ms, press0, press0 + POLL);
+
+        // Pinned: the one reading comes before calibration, against baselineMQ = 1.0,
+        // so a fresh 600-count fridge reads SPOILED. A baseline fix must update this.
+        std::string state = jsonState(t.publishes[0].payload);
+        c.expect(state == "SPOILED", "published %s, expected SPOILED (stale baseline)", state.c_str());
+        c.expect(lcdShows(t, "SPOILED"), "LCD row 0 is \"%s\", expected SPOILED", t.lcd[0]);
+        c.expect(t.i2cTransactions <= 10, "%lu I2C transactions for 5 screen updates", t.i2cTransactions);
+        c.expect(t.lcdSetupViolations == 0, "%lu LCD strobes with RS not settled", t.lcdSetupViolations);
+        for(int pin : { LED_GREEN, LED_YELLOW, LED_RED })
+          c.expect(pinLevel(t, pin, dur) == 0, "LED %d still on after the sequence", pin);
+      },
+      1000 });
+  }
+
+  {
+    const uint64_t first = 10 * SEC, second = 60 * SEC;
+    v.push_back({ "two_activations", "Second activation has no reading: LCD says so instead of inviting a measurement",
+      2 * MIN, fridge(), { press(first), press(second) },
+      [second](const Trace &t, Check &c) {
+        c.expect(t.publishes.size() == 1, "%zu publishes, expected 1", t.publishes.size());
+        c.expect(countPublishes(t, second, 2 * MIN) == 0, "published on the second activation");
+        c.expect(lcdShows(t, "NO READING") && lcdShows(t, "Reset to retry", 1),
+                 "LCD shows [%s][%s], expected NO READING / Reset to retry", t.lcd[0], t.lcd[1]);
+        c.expect(t.lcdSetupViolations == 0, "%lu LCD strobes with RS not settled", t.lcdSetupViolations);
+        for(int pin : { LED_GREEN, LED_YELLOW, LED_RED })
+          c.expect(pinLevel(t, pin, second + CALIB + SEQUENCE) == 0, "LED %d still on after the sequence", pin);
+      } });
+  }
+
+  {
+    const uint64_t down = 1 * MIN, press0 = 2 * MIN, up = 3 * MIN + 1500;
+    v.push_back({ "outage_at_press", "Broker down during the activation: reading is lost, LCD still updates",
+      10 * MIN, fridge(), { brokerDown(down), press(press0), brokerUp(up) },
+      [up](const Trace &t, Check &c) {
+        c.expect(t.publishes.empty(), "%zu publishes with the broker down", t.publishes.size());
+        c.expect(!lcdShows(t, "SYSTEM OFF") && !lcdShows(t, "CALIBRATING"), "LCD row 0 is \"%s\"", t.lcd[0]);
+
+        uint64_t reconnect = 0;
+        for(uint64_t ms : t.mqttConnects) if(ms >= up) { reconnect = ms; break; }
+        c.expect(reconnect != 0, "never reconnected");
+        if(reconnect) c.between("reconnect", reconnect, up, up + RETRY + 100);
+      } });
+  }
+
+  v.push_back({ "idle_48h", "Two days powered but never activated",
+    48 * HOUR, fridge(), {},
+    [](const Trace &t, Check &c) {
+      c.expect(t.publishes.empty(), "%zu publishes while OFF", t.publishes.size());
+      c.expect(lcdShows(t, "SYSTEM OFF"), "LCD row 0 is \"%s\"", t.lcd[0]);
+    },
+    1000 });
+
+  return v;
+}
+
+} // namespace
+
+const std::vector<Scenario> &sim::scenarios() {
+  static const std::vector<Scenario> all = build();
+  return all;
+}
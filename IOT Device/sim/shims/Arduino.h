@@ -0,0 +1,94 @@
+// Arduino core subset for the host simulator
+// Pins, ADC, timing and Serial are routed to the scripted world in sim::.
+
+#pragma once
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string>
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define IRAM_ATTR
+
+// --- String ---
+class String {
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  explicit String(int v) : s_(std::to_string(v)) {}
+  explicit String(unsigned long v) : s_(std::to_string(v)) {}
+  explicit String(float v, unsigned char decimals = 2);
+  explicit String(double v, unsigned char decimals = 2) : String((float)v, decimals) {}
+
+  const char *c_str() const { return s_.c_str(); }
+  unsigned int length() const { return (unsigned int)s_.size(); }
+
+  String &operator+=(const String &o) { s_ += o.s_; return *this; }
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+  friend String operator+(const String &a, const char *b) { return String(a.s_ + b); }
+  friend String operator+(const String &a, int v)         { return a + String(v); }
+  friend String operator+(const String &a, float v)       { return a + String(v); }
+  friend String operator+(const String &a, double v)      { return a + String(v); }
+  bool operator==(const char *o) const { return s_ == o; }
+
+private:
+  std::string s_;
+};
+
+// --- IPAddress ---
+class IPAddress {
+public:
+  IPAddress(uint8_t a=0, uint8_t b=0, uint8_t c=0, uint8_t d=0) : a_(a), b_(b), c_(c), d_(d) {}
+  String toString() const;
+private:
+  uint8_t a_, b_, c_, d_;
+};
+
+// --- Serial ---
+class HardwareSerial {
+public:
+  void begin(unsigned long) {}
+  void print(const char *s);
+  void print(const String &s) { print(s.c_str()); }
+  void print(char c);
+  void print(int v);
+  void print(unsigned int v)  { print(String((unsigned long)v)); }
+  void print(long v)          { print((int)v); }
+  void print(unsigned long v) { print(String(v)); }
+  void print(double v, int digits = 2) { print(String(v, (unsigned char)digits)); }
+  void print(const IPAddress &ip) { print(ip.toString()); }
+
+  template <typename T> void println(const T &v) { print(v); println(); }
+  void println(double v, int digits) { print(v, digits); println(); }
+  void println();
+
+private:
+  std::string line_;
+};
+extern HardwareSerial Serial;
+
+// --- Core ---
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalRead(uint8_t pin);
+int  analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+// Sketch entry points
+void setup();
+void loop();
@@ -0,0 +1,14 @@
+// DHT sensor shim: readings come from the scenario's temp/hum curves
+#pragma once
+#include <Arduino.h>
+
+#define DHT11 11
+#define DHT22 22
+
+class DHT {
+public:
+  DHT(uint8_t pin, uint8_t type) { (void)pin; (void)type; }
+  void begin() {}
+  float readTemperature();
+  float readHumidity();
+};
@@ -0,0 +1,24 @@
+// PubSubClient shim: a broker that is reachable while World::brokerUp is true
+// Published messages are recorded in sim::trace().publishes.
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+
+#define MQTT_CONNECTION_TIMEOUT  -4
+#define MQTT_CONNECTION_LOST     -3
+#define MQTT_CONNECT_FAILED      -2
+#define MQTT_DISCONNECTED        -1
+#define MQTT_CONNECTED            0
+
+class PubSubClient {
+public:
+  explicit PubSubClient(WiFiClient &) {}
+  PubSubClient &setServer(const char *host, uint16_t port) { (void)host; (void)port; return *this; }
+  bool connect(const char *id);
+  bool connected();
+  bool publish(const char *topic, const char *payload, bool retained = false);
+  bool loop() { return connected(); }
+  int state() { return state_; }
+private:
+  int state_ = MQTT_DISCONNECTED;
+};
@@ -0,0 +1,15 @@
+// WiFi shim: joins after World::wifiJoinMs, drops while World::wifiUp is false
+#pragma once
+#include <Arduino.h>
+
+typedef enum { WL_IDLE_STATUS = 0, WL_CONNECTED = 3, WL_DISCONNECTED = 6 } wl_status_t;
+
+class WiFiClass {
+public:
+  void begin(const char *ssid, const char *password);
+  wl_status_t status();
+  IPAddress localIP() { return IPAddress(192, 168, 1, 50); }
+};
+extern WiFiClass WiFi;
+
+class WiFiClient {};
@@ -0,0 +1,22 @@
+// TwoWire shim: transactions are counted and fed to a simulated PCF8574 + HD44780
+// endTransmission() blocks the caller for the 100 kHz wire time, like the real driver.
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire {
+public:
+  bool begin() { return true; }
+  void setClock(uint32_t hz) { clock_ = hz; }
+  void beginTransmission(uint8_t addr) { addr_ = addr; buf_.clear(); }
+  size_t write(uint8_t b) { buf_.push_back(b); return 1; }
+  size_t write(const uint8_t *data, size_t len) { buf_.insert(buf_.end(), data, data + len); return len; }
+  uint8_t endTransmission(bool sendStop = true);
+private:
+  uint8_t addr_ = 0;
+  uint32_t clock_ = 100000;
+  std::vector<uint8_t> buf_;
+};
+extern TwoWire Wire;
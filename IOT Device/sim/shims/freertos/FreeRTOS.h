@@ -0,0 +1,51 @@
+// FreeRTOS API subset used by the firmware, scheduled on the simulator's virtual clock
+// Tasks are coroutines: a task runs until it blocks, then the scheduler
+// picks the next ready one or advances time. There is no preemption.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+typedef void (*TaskFunction_t)(void *);
+
+struct SimTask;
+struct SimQueue;
+typedef SimTask  *TaskHandle_t;
+typedef SimQueue *QueueHandle_t;
+typedef SimQueue *SemaphoreHandle_t;
+
+#define pdFALSE  0
+#define pdTRUE   1
+#define pdPASS   pdTRUE
+#define pdFAIL   pdFALSE
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFFUL)
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define tskIDLE_PRIORITY   0
+#define tskNO_AFFINITY     0x7FFFFFFF
+
+#define portYIELD_FROM_ISR(...) ((void)0)
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *handle);
+void       vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t    xQueueSend(QueueHandle_t q, const void *item, TickType_t wait);
+BaseType_t    xQueueOverwrite(QueueHandle_t q, const void *item);
+BaseType_t    xQueueReceive(QueueHandle_t q, void *item, TickType_t wait);
+BaseType_t    xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken);
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t        xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken);
@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include "Sim.h"
+#include <map>
+
+HardwareSerial Serial;
+
+String::String(float v, unsigned char decimals) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+  s_ = buf;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", a_, b_, c_, d_);
+  return String(buf);
+}
+
+// --- Serial: complete lines go to the trace ---
+void HardwareSerial::print(const char *s) {
+  for(; *s; s++){
+    if(*s == '\n') println();
+    else if(*s != '\r') line_ += *s;
+  }
+}
+void HardwareSerial::print(char c) { char s[2] = { c, 0 }; print(s); }
+void HardwareSerial::print(int v)  { print(String(v)); }
+void HardwareSerial::println() {
+  sim::serialLine(line_);
+  line_.clear();
+}
+
+// --- Pins ---
+static std::map<int, int> levels;
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if(mode == INPUT_PULLUP) levels[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  int v = val ? HIGH : LOW;
+  auto it = levels.find(pin);
+  if(it != levels.end() && it->second == v) return;
+  levels[pin] = v;
+  sim::pinChanged(pin, v);
+}
+
+int digitalRead(uint8_t pin) { return levels.count(pin) ? levels[pin] : LOW; }
+
+int analogRead(uint8_t) {
+  const sim::World &w = sim::world();
+  int v = w.mq ? w.mq(sim::nowMs()) : 0;
+  return v < 0 ? 0 : v > 4095 ? 4095 : v;   // 12-bit ADC
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) { sim::attachIsr(pin, isr, mode); }
+
+// --- Time ---
+unsigned long millis() { return (unsigned long)sim::nowMs(); }
+unsigned long micros() { return (unsigned long)sim::nowUs(); }
+void delay(uint32_t ms) { sim::rtosSleepUs((uint64_t)ms * 1000); }
+void delayMicroseconds(uint32_t us) { sim::rtosSleepUs(us); }
@@ -0,0 +1,97 @@
+// Simulated peripherals: DHT11, WiFi, MQTT broker, I2C LCD backpack
+
+#include <DHT.h>
+#include <WiFi.h>
+#include <PubSubClient.h>
+#include <Wire.h>
+#include <LiquidCrystal_I2C.h>
+#include "Sim.h"
+#include "MockLcdBus.h"
+#include <string.h>
+
+const uint64_t MQTT_CONNECT_US      = 20 * 1000;     // CONNECT/CONNACK round trip
+const uint64_t MQTT_CONNECT_FAIL_US = 1000 * 1000;   // TCP connect timeout to a dead broker
+
+WiFiClass WiFi;
+TwoWire Wire;
+
+// --- DHT ---
+float DHT::readTemperature() {
+  const sim::World &w = sim::world();
+  return w.temp ? w.temp(sim::nowMs()) : NAN;
+}
+
+float DHT::readHumidity() {
+  const sim::World &w = sim::world();
+  return w.hum ? w.hum(sim::nowMs()) : NAN;
+}
+
+// --- WiFi ---
+static bool wifiBegun = false;
+static uint64_t wifiBeginMs = 0;
+
+void WiFiClass::begin(const char *, const char *) {
+  wifiBegun = true;
+  wifiBeginMs = sim::nowMs();
+}
+
+wl_status_t WiFiClass::status() {
+  const sim::World &w = sim::world();
+  if(!wifiBegun || !w.wifiUp) return WL_DISCONNECTED;
+  return sim::nowMs() - wifiBeginMs >= w.wifiJoinMs ? WL_CONNECTED : WL_IDLE_STATUS;
+}
+
+// --- MQTT ---
+static bool brokerReachable() {
+  return sim::world().brokerUp && WiFi.status() == WL_CONNECTED;
+}
+
+bool PubSubClient::connect(const char *) {
+  if(!brokerReachable()){
+    sim::rtosSleepUs(MQTT_CONNECT_FAIL_US);
+    state_ = MQTT_CONNECT_FAILED;
+    return false;
+  }
+  sim::rtosSleepUs(MQTT_CONNECT_US);
+  state_ = MQTT_CONNECTED;
+  sim::trace().mqttConnects.push_back(sim::nowMs());
+  return true;
+}
+
+bool PubSubClient::connected() {
+  if(state_ == MQTT_CONNECTED && !brokerReachable()) state_ = MQTT_CONNECTION_LOST;
+  return state_ == MQTT_CONNECTED;
+}
+
+bool PubSubClient::publish(const char *topic, const char *payload, bool retained) {
+  if(!connected()) return false;
+  sim::trace().publishes.push_back({ sim::nowMs(), topic, payload, retained });
+  return true;
+}
+
+// --- I2C: PCF8574 backpack driving an HD44780 in 4-bit mode ---
+// Decoded by FoodGuard-2's MockLcdBus, the reference extras/bus_cost.cpp checks against.
+static MockLcdBus lcd;
+
+void sim::lcdReset() { lcd = MockLcdBus(); }
+
+void sim::i2cTransfer(uint8_t, const uint8_t *data, size_t len) {
+  lcd.transmit(data, len);
+  sim::Trace &t = sim::trace();
+  for(uint8_t r=0; r<2; r++)
+    for(uint8_t c=0; c<16; c++) t.lcd[r][c] = lcd.cell(r, c);
+  t.lcdSetupViolations = lcd.setupViolations;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  sim::Trace &t = sim::trace();
+  t.i2cTransactions++;
+  t.i2cBytes += buf_.size();
+  sim::i2cTransfer(addr_, buf_.data(), buf_.size());
+  // START + address + ACK + STOP, then 9 bits per data byte
+  uint64_t bits = 11 + 9 * (uint64_t)buf_.size();
+  sim::rtosSleepUs(bits * 1000000 / clock_);
+  return 0;
+}
+
+void LiquidCrystal_I2C::init() { sim::lcdReset(); }
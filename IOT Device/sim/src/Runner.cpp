@@ -0,0 +1,202 @@
+// Scenario runner: each scenario boots a fresh firmware image in its own
+// process (the sketch keeps its state in globals), replays it on the virtual
+// clock and reports simulated time, wall time and the resulting speedup.
+//
+//   foodguard_sim_v1              run every scenario
+//   foodguard_sim_v1 NAME... [-v] run the named ones, -v echoes Serial output
+//   foodguard_sim_v1 --list
+
+#include <Arduino.h>
+#include "Sim.h"
+#include <math.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+namespace sim {
+
+static World theWorld;
+static Trace theTrace;
+static bool echo = false;
+static std::map<int, std::pair<void (*)(), int>> isrs;
+
+World &world() { return theWorld; }
+Trace &trace() { return theTrace; }
+bool verbose() { return echo; }
+
+void serialLine(const std::string &line) {
+  theTrace.serialLines++;
+  if(theTrace.serial.size() < kSerialKeep) theTrace.serial.push_back(line);
+  if(echo) fprintf(stderr, "[%11.3f] %s\n", nowUs() / 1e6, line.c_str());
+}
+
+void pinChanged(int pin, int level) { theTrace.pins.push_back({ nowMs(), pin, level }); }
+
+void attachIsr(int pin, void (*isr)(), int mode) { isrs[pin] = { isr, mode }; }
+
+// --- Events ---
+Event press(uint64_t ms) {
+  return { ms, [] {
+    for(auto &it : isrs)
+      if(it.second.second == FALLING || it.second.second == CHANGE) it.second.first();
+  } };
+}
+Event brokerDown(uint64_t ms) { return { ms, [] { theWorld.brokerUp = false; } }; }
+Event brokerUp(uint64_t ms)   { return { ms, [] { theWorld.brokerUp = true; } }; }
+Event wifiDown(uint64_t ms)   { return { ms, [] { theWorld.wifiUp = false; } }; }
+Event wifiUp(uint64_t ms)     { return { ms, [] { theWorld.wifiUp = true; } }; }
+
+// --- Checks ---
+static std::vector<std::string> messages;
+
+void Check::expect(bool ok, const char *fmt, ...) {
+  if(ok) return;
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  messages.push_back(buf);
+  this->failures++;
+}
+
+void Check::within(const char *what, uint64_t actualMs, uint64_t expectedMs, uint64_t tolMs) {
+  uint64_t diff = actualMs > expectedMs ? actualMs - expectedMs : expectedMs - actualMs;
+  expect(diff <= tolMs, "%s at %.3f s, expected %.3f s +/- %.3f s",
+         what, actualMs / 1e3, expectedMs / 1e3, tolMs / 1e3);
+}
+
+void Check::between(const char *what, uint64_t actualMs, uint64_t loMs, uint64_t hiMs) {
+  expect(actualMs >= loMs && actualMs <= hiMs, "%s at %.3f s, expected between %.3f s and %.3f s",
+         what, actualMs / 1e3, loMs / 1e3, hiMs / 1e3);
+}
+
+std::string jsonState(const std::string &payload) {
+  const char *key = "\"state\":\"";
+  size_t p = payload.find(key);
+  if(p == std::string::npos) return "";
+  p += strlen(key);
+  size_t e = payload.find('"', p);
+  return e == std::string::npos ? "" : payload.substr(p, e - p);
+}
+
+const Publish *firstPublish(const Trace &t, uint64_t afterMs, const char *state) {
+  for(const Publish &p : t.publishes)
+    if(p.ms >= afterMs && (!state || jsonState(p.payload) == state)) return &p;
+  return nullptr;
+}
+
+size_t countPublishes(const Trace &t, uint64_t fromMs, uint64_t toMs) {
+  size_t n = 0;
+  for(const Publish &p : t.publishes) if(p.ms >= fromMs && p.ms < toMs) n++;
+  return n;
+}
+
+bool serialContains(const Trace &t, const char *text) {
+  for(const std::string &l : t.serial) if(l.find(text) != std::string::npos) return true;
+  return false;
+}
+
+int pinLevel(const Trace &t, int pin, uint64_t atMs) {
+  int level = LOW;
+  for(const PinEdge &e : t.pins){
+    if(e.ms > atMs) break;
+    if(e.pin == pin) level = e.level;
+  }
+  return level;
+}
+
+// --- Curves ---
+std::function<int(uint64_t)> logistic(int a, int b, uint64_t midMs, uint64_t riseMs, int noise) {
+  const double k = riseMs / (2.0 * log(9.0));
+  return [=](uint64_t ms) {
+    double x = ((double)ms - (double)midMs) / k;
+    int v = (int)lround(a + (b - a) / (1.0 + exp(-x)));
+    if(noise > 0) v += (int)(((ms / 100) * 2654435761ULL >> 16) % (2 * noise + 1)) - noise;
+    return v;
+  };
+}
+
+std::function<float(uint64_t)> constant(float v) {
+  return [v](uint64_t) { return v; };
+}
+
+uint64_t crossingMs(const std::function<int(uint64_t)> &curve, int level, uint64_t fromMs, uint64_t toMs) {
+  for(uint64_t ms = fromMs; ms < toMs; ms += 100)
+    if(curve(ms) >= level) return ms;
+  return UINT64_MAX;
+}
+
+// --- Runner ---
+static std::string hms(uint64_t ms) {
+  char buf[32];
+  uint64_t s = ms / 1000;
+  snprintf(buf, sizeof(buf), "%uh%02um%02us", (unsigned)(s / 3600), (unsigned)(s / 60 % 60), (unsigned)(s % 60));
+  return buf;
+}
+
+static int runOne(const Scenario &s) {
+  theWorld = s.world;
+  std::vector<Event> events = s.events;
+  std::stable_sort(events.begin(), events.end(), [](const Event &a, const Event &b) { return a.ms < b.ms; });
+
+  auto t0 = std::chrono::steady_clock::now();
+  rtosRun(setup, loop, events, s.durationMs);
+  double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+  double speedup = s.durationMs / std::max(wallMs, 0.001);
+
+  Check c;
+  if(s.check) s.check(theTrace, c);
+  if(s.minSpeedup > 0) c.expect(speedup >= s.minSpeedup, "speedup %.0fx below %.0fx", speedup, s.minSpeedup);
+
+  printf("%-24s %11s %10.1f %12.0fx %6zu %9lu  %s\n", s.name, hms(s.durationMs).c_str(), wallMs, speedup,
+         theTrace.publishes.size(), theTrace.contextSwitches, c.passed() ? "ok" : "FAIL");
+  for(const std::string &f : messages) printf("    %s\n", f.c_str());
+  return c.passed() ? 0 : 1;
+}
+
+} // namespace sim
+
+int main(int argc, char **argv) {
+  std::vector<std::string> names;
+  for(int i=1; i<argc; i++){
+    if(!strcmp(argv[i], "-v")) sim::echo = true;
+    else if(!strcmp(argv[i], "--list")){
+      for(const sim::Scenario &s : sim::scenarios()) printf("%-24s %s\n", s.name, s.summary);
+      return 0;
+    }
+    else names.push_back(argv[i]);
+  }
+
+  std::vector<const sim::Scenario *> todo;
+  for(const sim::Scenario &s : sim::scenarios())
+    if(names.empty() || std::find(names.begin(), names.end(), s.name) != names.end()) todo.push_back(&s);
+  if(todo.size() != (names.empty() ? sim::scenarios().size() : names.size())){
+    fprintf(stderr, "unknown scenario, see --list\n");
+    return 2;
+  }
+
+  printf("%-24s %11s %10s %13s %6s %9s\n", "scenario", "simulated", "wall ms", "speedup", "pubs", "switches");
+  int failed = 0;
+  for(const sim::Scenario *s : todo){
+    fflush(stdout);
+    pid_t pid = fork();
+    if(pid == 0){
+      int rc = sim::runOne(*s);
+      fflush(stdout);
+      _exit(rc);   // tasks are still parked mid-function, skip static destructors
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+      if(!WIFEXITED(status)) printf("%-24s crashed\n", s->name);
+      failed++;
+    }
+  }
+  printf("%zu scenario(s), %d failed\n", todo.size(), failed);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,110 @@
+// FoodGuard host simulator: virtual clock, scripted world, recorded trace
+// The firmware is compiled unchanged against the shims in ../shims; every
+// delay/block in it advances a virtual clock instead of waiting for real.
+
+#pragma once
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+// --- Virtual clock ---
+uint64_t nowUs();
+inline uint64_t nowMs() { return nowUs() / 1000; }
+
+const uint64_t SEC  = 1000;           // scenario times are in ms
+const uint64_t MIN  = 60 * SEC;
+const uint64_t HOUR = 60 * MIN;
+
+// --- Scripted world (what the sensors and the network see) ---
+struct World {
+  std::function<int(uint64_t ms)>   mq;     // MQ135 ADC counts
+  std::function<float(uint64_t ms)> temp;   // degC, NAN = DHT read error
+  std::function<float(uint64_t ms)> hum;    // %RH, NAN = DHT read error
+  uint64_t wifiJoinMs = 3 * SEC;            // association time after WiFi.begin()
+  bool wifiUp   = true;
+  bool brokerUp = true;
+};
+World &world();
+
+// --- Trace (what the firmware did) ---
+struct Publish { uint64_t ms; std::string topic; std::string payload; bool retained; };
+struct PinEdge { uint64_t ms; int pin; int level; };
+
+struct Trace {
+  std::vector<Publish>  publishes;
+  std::vector<PinEdge>  pins;
+  std::vector<uint64_t> mqttConnects;
+  std::vector<std::string> serial;        // first lines only, see kSerialKeep
+  unsigned long serialLines = 0;
+  unsigned long contextSwitches = 0;
+  unsigned long i2cTransactions = 0;
+  unsigned long i2cBytes = 0;
+  unsigned long lcdSetupViolations = 0;   // EN rose in the write that changed RS (tAS)
+  char lcd[2][17] = { "                ", "                " };
+};
+Trace &trace();
+const size_t kSerialKeep = 2000;
+
+// --- Scenario ---
+struct Event { uint64_t ms; std::function<void()> fire; };
+
+Event press(uint64_t ms);          // button falling edge -> firmware ISR
+Event brokerDown(uint64_t ms);
+Event brokerUp(uint64_t ms);
+Event wifiDown(uint64_t ms);
+Event wifiUp(uint64_t ms);
+
+class Check {
+public:
+  void expect(bool ok, const char *fmt, ...);
+  void within(const char *what, uint64_t actualMs, uint64_t expectedMs, uint64_t tolMs);
+  void between(const char *what, uint64_t actualMs, uint64_t loMs, uint64_t hiMs);
+  bool passed() const { return failures == 0; }
+private:
+  int failures = 0;
+};
+
+struct Scenario {
+  const char *name;
+  const char *summary;
+  uint64_t durationMs;
+  World world;
+  std::vector<Event> events;
+  std::function<void(const Trace &, Check &)> check;
+  double minSpeedup = 0;            // simulated/wall time, 0 = not asserted
+};
+
+// Provided by scenarios/*.cpp for the firmware being built
+const std::vector<Scenario> &scenarios();
+
+// --- Trace helpers for checks ---
+std::string jsonState(const std::string &payload);                 // "state" field
+const Publish *firstPublish(const Trace &t, uint64_t afterMs, const char *state = nullptr);
+size_t countPublishes(const Trace &t, uint64_t fromMs, uint64_t toMs);
+bool serialContains(const Trace &t, const char *text);
+int pinLevel(const Trace &t, int pin, uint64_t atMs);                 // LOW before the first edge
+
+// --- Curve helpers ---
+// Smooth step from a to b centred on midMs, 10-90% rise over riseMs
+std::function<int(uint64_t)> logistic(int a, int b, uint64_t midMs, uint64_t riseMs, int noise = 0);
+std::function<float(uint64_t)> constant(float v);
+// First time in [fromMs, toMs) the curve reaches level, UINT64_MAX if never
+uint64_t crossingMs(const std::function<int(uint64_t)> &curve, int level, uint64_t fromMs, uint64_t toMs);
+
+// --- Internals shared by the shims ---
+void serialLine(const std::string &line);
+void pinChanged(int pin, int level);
+void attachIsr(int pin, void (*isr)(), int mode);
+void i2cTransfer(uint8_t addr, const uint8_t *data, size_t len);
+void lcdReset();
+
+// Virtual RTOS (VirtualRtos.cpp)
+void rtosSleepUs(uint64_t us);
+void rtosRun(void (*setup)(), void (*loop)(), const std::vector<Event> &events, uint64_t endMs);
+
+bool verbose();
+
+} // namespace sim
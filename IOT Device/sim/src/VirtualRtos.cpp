@@ -0,0 +1,234 @@
+// Discrete-event FreeRTOS: one coroutine per task, one virtual clock
+// The driver switches to the highest-priority ready task and gets control
+// back when that task blocks. With nothing ready it jumps the clock to the
+// next wake-up or scripted event, so idle hours cost nothing.
+
+#include "Sim.h"
+#include "freertos/FreeRTOS.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+#include <deque>
+
+enum TaskState { READY, SLEEPING, BLOCKED, POLLING, DONE };
+
+struct SimTask {
+  std::string name;
+  UBaseType_t prio;
+  TaskState state;
+  uint64_t wakeUs;        // SLEEPING/BLOCKED deadline, UINT64_MAX = forever
+  SimQueue *waitOn;
+  uint64_t readySeq;      // FIFO among equal priorities
+  ucontext_t ctx;
+  std::vector<char> stack;
+  TaskFunction_t fn;
+  void *arg;
+};
+
+struct SimQueue {
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+namespace sim {
+
+static ucontext_t driverCtx;
+static std::vector<SimTask *> tasks;
+static SimTask *current = nullptr;
+static uint64_t now = 0;
+static uint64_t seq = 0;
+
+static void (*fwSetup)() = nullptr;
+static void (*fwLoop)() = nullptr;
+
+const unsigned long kLivelock = 1000000;   // switches without the clock moving
+const size_t kTaskStack = 256 * 1024;      // host stack, the firmware's sizes are for the ESP32
+
+uint64_t nowUs() { return now; }
+
+static void makeReady(SimTask *t) {
+  t->state = READY;
+  t->waitOn = nullptr;
+  t->readySeq = ++seq;
+}
+
+// Return to the driver until scheduled again
+static void park() {
+  swapcontext(&current->ctx, &driverCtx);
+}
+
+static void block(TaskState st, uint64_t wakeUs, SimQueue *q) {
+  if(!current) { fprintf(stderr, "sim: blocking call outside a task\n"); abort(); }
+  current->state = st;
+  current->wakeUs = wakeUs;
+  current->waitOn = q;
+  park();
+}
+
+static void taskMain() {
+  current->fn(current->arg);
+  current->state = DONE;   // uc_link resumes the driver
+}
+
+static SimTask *spawn(TaskFunction_t fn, const char *name, void *arg, UBaseType_t prio) {
+  SimTask *t = new SimTask();
+  t->name = name;
+  t->prio = prio;
+  t->fn = fn;
+  t->arg = arg;
+  t->stack.resize(kTaskStack);
+  getcontext(&t->ctx);
+  t->ctx.uc_stack.ss_sp = t->stack.data();
+  t->ctx.uc_stack.ss_size = t->stack.size();
+  t->ctx.uc_link = &driverCtx;
+  makecontext(&t->ctx, taskMain, 0);
+  makeReady(t);
+  tasks.push_back(t);
+  return t;
+}
+
+// Arduino-ESP32 loopTask: setup() once, then loop() forever. loop() only polls,
+// so after each pass it sleeps until something else happens in the world.
+static void loopTask(void *) {
+  fwSetup();
+  for(;;){
+    fwLoop();
+    block(POLLING, UINT64_MAX, nullptr);
+  }
+}
+
+void rtosSleepUs(uint64_t us) {
+  if(!current) return;
+  if(us == 0) { makeReady(current); park(); return; }
+  block(SLEEPING, now + us, nullptr);
+}
+
+static SimTask *pickReady() {
+  SimTask *best = nullptr;
+  for(SimTask *t : tasks){
+    if(t->state != READY) continue;
+    if(!best || t->prio > best->prio || (t->prio == best->prio && t->readySeq < best->readySeq)) best = t;
+  }
+  return best;
+}
+
+void rtosRun(void (*setup)(), void (*loop)(), const std::vector<Event> &events, uint64_t endMs) {
+  fwSetup = setup;
+  fwLoop = loop;
+  spawn(loopTask, "loopTask", nullptr, 1);
+
+  const uint64_t endUs = endMs * 1000;
+  size_t ev = 0;
+  unsigned long sameTime = 0;
+
+  for(;;){
+    SimTask *t = pickReady();
+    if(t){
+      current = t;
+      swapcontext(&driverCtx, &t->ctx);
+      current = nullptr;
+      trace().contextSwitches++;
+      if(++sameTime > kLivelock){
+        fprintf(stderr, "sim: livelock at %.3f s, last task \"%s\" never blocks\n", now / 1e6, t->name.c_str());
+        abort();
+      }
+      continue;
+    }
+
+    // Nothing ready: jump to the next wake-up or scripted event
+    uint64_t next = endUs;
+    for(SimTask *w : tasks)
+      if((w->state == SLEEPING || w->state == BLOCKED) && w->wakeUs < next) next = w->wakeUs;
+    if(ev < events.size() && events[ev].ms * 1000 < next) next = events[ev].ms * 1000;
+    if(next >= endUs) { now = endUs; break; }
+    if(next > now) { now = next; sameTime = 0; }
+
+    for(SimTask *w : tasks)
+      if((w->state == SLEEPING || w->state == BLOCKED) && w->wakeUs <= now) makeReady(w);
+    while(ev < events.size() && events[ev].ms * 1000 <= now) events[ev++].fire();
+    for(SimTask *w : tasks)
+      if(w->state == POLLING) makeReady(w);
+  }
+}
+
+// --- Queues & semaphores ---
+static void wakeWaiters(SimQueue *q) {
+  for(SimTask *t : tasks)
+    if(t->state == BLOCKED && t->waitOn == q) makeReady(t);
+}
+
+static BaseType_t put(SimQueue *q, const void *item, bool overwrite) {
+  if(!q) return pdFAIL;
+  if(q->items.size() >= q->length){
+    if(!overwrite) return pdFAIL;
+    q->items.pop_back();
+  }
+  std::vector<uint8_t> bytes(q->itemSize);
+  if(item && q->itemSize) memcpy(bytes.data(), item, q->itemSize);
+  q->items.push_back(bytes);
+  wakeWaiters(q);
+  return pdPASS;
+}
+
+static BaseType_t take(SimQueue *q, void *item, TickType_t wait) {
+  if(!q) return pdFAIL;
+  const uint64_t deadline = (wait == portMAX_DELAY) ? UINT64_MAX : now + (uint64_t)wait * 1000;
+  for(;;){
+    if(!q->items.empty()){
+      if(item && q->itemSize) memcpy(item, q->items.front().data(), q->itemSize);
+      q->items.pop_front();
+      return pdPASS;
+    }
+    if(wait == 0 || now >= deadline || !current) return pdFAIL;
+    block(BLOCKED, deadline, q);
+  }
+}
+
+static SimQueue *newQueue(UBaseType_t length, UBaseType_t itemSize) {
+  SimQueue *q = new SimQueue();
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+
+} // namespace sim
+
+// --- FreeRTOS API ---
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t) {
+  SimTask *t = sim::spawn(fn, name, arg, prio);
+  if(handle) *handle = t;
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelay(TickType_t ticks) { sim::rtosSleepUs((uint64_t)ticks * 1000); }
+TickType_t xTaskGetTickCount() { return (TickType_t)(sim::now / 1000); }
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) { return sim::newQueue(length, itemSize); }
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t) { return sim::put(q, item, false); }
+BaseType_t xQueueOverwrite(QueueHandle_t q, const void *item) { return sim::put(q, item, true); }
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) { return sim::take(q, item, wait); }
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken) {
+  if(woken) *woken = pdFALSE;
+  return sim::put(q, item, false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() { return sim::newQueue(1, 0); }
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t m = sim::newQueue(1, 0);
+  sim::put(m, nullptr, false);
+  return m;
+}
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) { return sim::take(s, nullptr, wait); }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { return sim::put(s, nullptr, false); }
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t s, BaseType_t *woken) {
+  if(woken) *woken = pdFALSE;
+  return sim::put(s, nullptr, false);
+}